@@ -70,9 +70,11 @@ SOURCES      := AS_global.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
                 stores/ovStoreHistogram.C \
+                stores/ovStoreSummary.C \
                 \
                 stores/tgStore.C \
                 stores/tgTig.C \
+                stores/tgPackage.C \
                 stores/tgTigSizeAnalysis.C \
                 stores/tgTigMultiAlignDisplay.C \
                 \
@@ -114,6 +116,7 @@ SOURCES      := AS_global.C \
                 utgcns/libcns/abColumn.C \
                 utgcns/libcns/abMultiAlign.C \
                 utgcns/libcns/unitigConsensus.C \
+                utgcns/libcns/unitigConsensus-windows.C \
                 utgcns/libpbutgcns/AlnGraphBoost.C  \
                 \
                 gfa/gfa.C \
@@ -147,7 +150,6 @@ SRC_INCDIRS  := . \
                 utgcns/libcns \
                 utgcns/libpbutgcns \
                 utgcns/libNDFalcon \
-                utgcns/libboost \
                 overlapInCore \
                 overlapInCore/libedlib \
                 overlapInCore/liboverlap
@@ -186,6 +188,7 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 \
                 meryl/meryl.mk \
                 meryl/findSeedThreshold.mk \
+                meryl/lookup.mk \
                 \
                 sequence/sequence.mk \
                 \
@@ -8,13 +8,13 @@ ifeq "$(strip ${TARGET_DIR})" ""
   TARGET_DIR   := ../$(OSTYPE)-$(MACHINETYPE)
 endif
 
-TARGET   := lookup
-SOURCES  := lookup.C \
+TARGET   := merylLookupBenchmark
+SOURCES  := lookup.C
 
-SRC_INCDIRS  := . utility
+SRC_INCDIRS  := . .. ../utility ../stores
 
 TGT_LDFLAGS := -L${TARGET_DIR}/lib
-TGT_LDLIBS  := -lsequence -lbits -lkmer -lmeryl
-TGT_PREREQS := libmeryl.a
+TGT_LDLIBS  := -lcanu
+TGT_PREREQS := libcanu.a
 
 SUBMAKEFILES :=
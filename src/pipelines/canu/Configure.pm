@@ -852,8 +852,8 @@ sub configureAssembler () {
     #  Check some minimums.
 
     if ((getGlobal("ovsMemory") =~ m/^([0123456789.]+)-*[0123456789.]*$/) &&
-        ($1 < 0.25)) {
-        caExit("ovsMemory must be at least 0.25g or 256m", undef);
+        ($1 < 0.3)) {
+        caExit("ovsMemory must be at least 0.3g or 308m", undef);
     }
 
     #  2017-02-21 -- not sure why $err is being reported here if it doesn't stop.  What's in it?
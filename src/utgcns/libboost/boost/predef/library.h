@@ -1,14 +0,0 @@
-/*
-Copyright Rene Rivera 2008-2012
-Distributed under the Boost Software License, Version 1.0.
-(See accompanying file LICENSE_1_0.txt or copy at
-http://www.boost.org/LICENSE_1_0.txt)
-*/
-
-#ifndef BOOST_PREDEF_LIBRARY_H
-#define BOOST_PREDEF_LIBRARY_H
-
-#include <boost/predef/library/c.h>
-#include <boost/predef/library/std.h>
-
-#endif